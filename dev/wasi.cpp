@@ -25,6 +25,8 @@ __attribute__((import_module("env"), import_name("getClockMs")))
 extern double getClockMs(uint32_t clockId);
 __attribute__((import_module("env"), import_name("getClockResNs")))
 extern uint32_t getClockResNs(uint32_t clockId);
+__attribute__((import_module("env"), import_name("getConfigSlot")))
+extern uint32_t getConfigSlot();
 
 // Pointer to remote memory
 template<class T>
@@ -239,6 +241,126 @@ extern "C" {
 	}
 }
 
+//---- args/environ ----
+
+// NUL-terminated strings packed contiguously, with the pointer table precomputed so `*_get` is just two bulk copies
+struct StringList {
+	std::vector<char> chars;
+	std::vector<char> pending; // the JS fills this, then `commit()` checks it and moves it into `chars`
+
+	result_t commit(size_t count, bool isEnviron) {
+		std::vector<char> packed = std::move(pending);
+		pending.clear();
+		if (!packed.empty() && packed.back() != '\0') return EINVAL;
+
+		std::vector<uint32_t> offsets;
+		size_t start = 0;
+		bool hasEquals = false;
+		for (size_t i = 0; i < packed.size(); ++i) {
+			if (isEnviron && packed[i] == '=' && !hasEquals) {
+				if (i == start) return EINVAL; // empty name
+				hasEquals = true;
+			} else if (packed[i] == '\0') {
+				if (isEnviron && !hasEquals) return EINVAL; // environ entries are `NAME=value`
+				offsets.push_back(uint32_t(start));
+				start = i + 1;
+				hasEquals = false;
+			}
+		}
+		if (offsets.size() != count) return EINVAL; // an entry had an embedded NUL
+		chars = std::move(packed);
+		// offsets are the pointers for a buffer at address 0
+		pointers = std::move(offsets);
+		pointersBase = 0;
+		return 0;
+	}
+
+	result_t sizesGet(P32<size_t> count, P32<size_t> bufferSize) const {
+		count.set(pointers.size());
+		bufferSize.set(chars.size());
+		return 0;
+	}
+
+	result_t get(P32<P32<const char>> list, P32<char> buffer) {
+		if (pointers.empty()) return 0;
+		// Only rebase the pointer table when the other module gives us a different buffer
+		if (buffer.remotePointer != pointersBase) {
+			uint32_t delta = buffer.remotePointer - pointersBase;
+			for (auto &p : pointers) p += delta;
+			pointersBase = buffer.remotePointer;
+		}
+		memcpyToOther32(list.remotePointer, pointers.data(), uint32_t(pointers.size()*sizeof(uint32_t)));
+		memcpyToOther32(buffer.remotePointer, chars.data(), uint32_t(chars.size()));
+		return 0;
+	}
+private:
+	std::vector<uint32_t> pointers;
+	uint32_t pointersBase = 0;
+};
+
+struct ConfigSlot {
+	bool inUse = false;
+	StringList args, env;
+
+	StringList & list(uint32_t target) {
+		return target ? env : args;
+	}
+};
+
+static std::recursive_mutex configMutex;
+// one slot per JS `Wasi` object, so copies sharing this memory each have their own args/environ
+static std::vector<std::unique_ptr<ConfigSlot>> configSlots;
+// released slots, re-used by `config_createSlot()`
+static std::vector<uint32_t> configFreeSlots;
+
+static ConfigSlot emptyConfigSlot;
+ConfigSlot & configSlotFor(uint32_t slot) {
+	if (slot >= configSlots.size() || !configSlots[slot]->inUse) return emptyConfigSlot;
+	return *configSlots[slot];
+}
+
+extern "C" {
+	__attribute__((export_name("config_createSlot")))
+	uint32_t config_createSlot() {
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		uint32_t slot;
+		if (configFreeSlots.empty()) {
+			slot = uint32_t(configSlots.size());
+			configSlots.emplace_back(std::unique_ptr<ConfigSlot>{new ConfigSlot()});
+		} else {
+			slot = configFreeSlots.back();
+			configFreeSlots.pop_back();
+		}
+		configSlots[slot]->inUse = true;
+		return slot;
+	}
+	__attribute__((export_name("config_releaseSlot")))
+	void config_releaseSlot(uint32_t slot) {
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		auto &config = configSlotFor(slot);
+		if (&config == &emptyConfigSlot) return;
+		config = ConfigSlot{}; // frees the strings as well
+		configFreeSlots.push_back(slot);
+	}
+	// target is 0 for args, 1 for environ
+	__attribute__((export_name("config_setPending")))
+	char * config_setPending(uint32_t slot, uint32_t target, size_t size) {
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		auto &config = configSlotFor(slot);
+		if (&config == &emptyConfigSlot) return nullptr;
+		auto &pending = config.list(target).pending;
+		pending.resize(size);
+		return (size > 0) ? pending.data() : &dummyChar; // The JS will fill this with NUL-terminated strings
+	}
+	__attribute__((export_name("config_commit")))
+	result_t config_commit(uint32_t slot, uint32_t target, size_t count) {
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		auto &config = configSlotFor(slot);
+		if (&config == &emptyConfigSlot) return EINVAL;
+		return config.list(target).commit(count, target != 0);
+	}
+}
+
 //---- WASI implementation ----
 
 std::recursive_mutex iovecBufferMutex;
@@ -278,13 +400,13 @@ VfsHandle & getHandle(uint32_t fd) {
 extern "C" {
 	__attribute__((export_name("wasi32_snapshot_preview1__args_sizes_get")))
 	result_t wasi32_snapshot_preview1__args_sizes_get(P32<size_t> count, P32<size_t> bufferSize) {
-		count.set(0);
-		bufferSize.set(0);
-		return 0;
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		return configSlotFor(getConfigSlot()).args.sizesGet(count, bufferSize);
 	}
 	__attribute__((export_name("wasi32_snapshot_preview1__args_get")))
 	result_t wasi32_snapshot_preview1__args_get(P32<P32<const char>> args, P32<char> buffer) {
-		return 0;
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		return configSlotFor(getConfigSlot()).args.get(args, buffer);
 	}
 	__attribute__((export_name("wasi32_snapshot_preview1__clock_res_get")))
 	result_t wasi32_snapshot_preview1__clock_res_get(uint32_t clock_id, P32<uint64_t> resolution) {
@@ -302,13 +424,13 @@ extern "C" {
 	}
 	__attribute__((export_name("wasi32_snapshot_preview1__environ_sizes_get")))
 	result_t wasi32_snapshot_preview1__environ_sizes_get(P32<size_t> items, P32<size_t> totalSize) {
-		items.set(0);
-		totalSize.set(0);
-		return 0;
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		return configSlotFor(getConfigSlot()).env.sizesGet(items, totalSize);
 	}
 	__attribute__((export_name("wasi32_snapshot_preview1__environ_get")))
 	result_t wasi32_snapshot_preview1__environ_get(P32<P32<const char>> env, P32<char> buffer) {
-		return 0;
+		std::lock_guard<std::recursive_mutex> lock{configMutex};
+		return configSlotFor(getConfigSlot()).env.get(env, buffer);
 	}
 
 	__attribute__((export_name("wasi32_snapshot_preview1__fd_advise")))
@@ -130,6 +130,7 @@ class Wasi {
 				getClockMs(clockId) {
 					return Date.now();
 				},
+				getConfigSlot: _ => -1, // no per-copy args/environ yet, so `args_get()`/`environ_get()` report empty lists
 			}
 		};
 		// Yes, we recursively pass its own WASI implementation back in, indirectly - it should ever actually *use* these though